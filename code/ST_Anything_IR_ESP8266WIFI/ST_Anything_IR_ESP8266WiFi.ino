@@ -24,6 +24,7 @@
 //    2018-02-09  Dan Ogorchock  Added support for Hubitat Elevation Hub
 //    2018-09-04  K Andrews      Modified to support IR controlled devices
 //    2018-09-16  K Andrews      Added IR Timed Relay device examples
+//    2026-10-18  K Andrews      Added optional local UDP command channel
 //
 //******************************************************************************************
 //******************************************************************************************
@@ -40,6 +41,7 @@
 #include <Everything.h>      //Master Brain of ST_Anything library that ties everything together and performs ST Shield communications
 #include <EX_SwitchIR.h>     //Implements an Executer (EX) IR transmitter to toggle a device On/Off
 #include <S_TimedRelayIR.h>  // IR Timed relay
+#include <LocalCommandUDP.h> //Optional local UDP command channel that bypasses the hub
 
 //*************************************************************************************************
 //NodeMCU v1.0 ESP8266-12e Pin Definitions (makes it much easier as these match the board markings)
@@ -80,6 +82,10 @@ IPAddress hubIp(192, 168, x, y);    // smartthings/hubitat hub ip //  <---You mu
 const unsigned int hubPort = 39500;   // smartthings hub port
 //const unsigned int hubPort = 39501;   // hubitat hub port
 
+// Local UDP command channel, commands sent to this port skip the round trip through the hub
+// See LocalCommandUDP.h for the datagram format
+st::LocalCommandUDP localCommands(8091);
+
 //******************************************************************************************
 //st::Everything::callOnMsgSend() optional callback routine.  This is a sniffer to monitor
 //    data being sent to ST.  This allows a user to act on data changes locally within the
@@ -164,6 +170,9 @@ void setup()
   //Run the Everything class' init() routine which establishes WiFi communications with SmartThings Hub
   st::Everything::init();
 
+  //Start listening for local UDP commands (safe to comment out if not desired)
+  localCommands.begin();
+
   //*****************************************************************************
   //Add each sensor to the "Everything" Class
   //*****************************************************************************
@@ -197,4 +206,9 @@ void loop()
   //Execute the Everything run method which takes care of "Everything"
   //*****************************************************************************
   st::Everything::run();
+
+  //*****************************************************************************
+  //Handle any local UDP commands (safe to comment out if not desired)
+  //*****************************************************************************
+  localCommands.run();
 }
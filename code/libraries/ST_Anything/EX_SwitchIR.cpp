@@ -22,6 +22,7 @@
 //    2015-01-03  Dan & Daniel   Original Creation
 //    2018-08-30  Dan Ogorchock  Modified comment section above to comply with new Parent/Child Device Handler requirements
 //    2018-08-30  K Andrews      Initial version of the IR code transmitting switch
+//    2026-10-18  K Andrews      Switch state is kept in ESP8266 RTC memory so it survives a reset
 //
 //
 //******************************************************************************************
@@ -97,6 +98,15 @@
 // AIWARCT501	17
 // MIDEA		18
 // GICABLE		19
+//
+// Retaining the On/Off state
+// --------------------------
+//
+// On the ESP8266 the state of each switch is written to the RTC user memory every time it
+// changes, and read back in the constructor.  RTC memory survives a watchdog reset, a crash
+// or an OTA reboot (but not a power cycle), so init() reports the correct state straight
+// away instead of defaulting to off.  Each record holds a checksum that includes the
+// device name, so a cold boot or a reordered sketch simply starts from off.
 //******************************************************************************************
 
 #include "EX_SwitchIR.h"
@@ -104,6 +114,11 @@
 #include "Constants.h"
 #include "Everything.h"
 
+// RTC user memory is 128 blocks of 4 bytes, the first 32 blocks are used by the OTA updater
+#define EX_SWITCHIR_RTC_FIRST_BLOCK	32
+#define EX_SWITCHIR_RTC_BLOCKS		128
+#define EX_SWITCHIR_RTC_MAGIC		0x5A490000UL	// "ZI" in the top half of the record
+
 namespace st
 {
 //private  
@@ -148,16 +163,69 @@ namespace st
 	
   }
 
+  unsigned long EX_SwitchIR::rtcCheck(unsigned long data)
+  {
+    //FNV-1a over the record data and the device name
+    unsigned long hash = 2166136261UL;
+    for (byte i = 0; i < 4; i++)
+    {
+      hash = (hash ^ ((data >> (i * 8)) & 0xFF)) * 16777619UL;
+    }
+    String name = getName();
+    for (unsigned int i = 0; i < name.length(); i++)
+    {
+      hash = (hash ^ (byte)name[i]) * 16777619UL;
+    }
+    return hash;
+  }
+
+  void EX_SwitchIR::saveState()
+  {
+#if defined(ARDUINO_ARCH_ESP8266)
+    if (EX_SWITCHIR_RTC_FIRST_BLOCK + (m_nRtcSlot + 1) * 2 > EX_SWITCHIR_RTC_BLOCKS) return;
+
+    uint32_t record[2];
+    record[0] = EX_SWITCHIR_RTC_MAGIC | (m_bCurrentState == HIGH ? 1 : 0);
+    record[1] = rtcCheck(record[0]);
+    ESP.rtcUserMemoryWrite(EX_SWITCHIR_RTC_FIRST_BLOCK + m_nRtcSlot * 2, record, sizeof(record));
+#endif
+  }
+
+  bool EX_SwitchIR::restoreState()
+  {
+#if defined(ARDUINO_ARCH_ESP8266)
+    if (EX_SWITCHIR_RTC_FIRST_BLOCK + (m_nRtcSlot + 1) * 2 > EX_SWITCHIR_RTC_BLOCKS) return false;
+
+    uint32_t record[2];
+    if (!ESP.rtcUserMemoryRead(EX_SWITCHIR_RTC_FIRST_BLOCK + m_nRtcSlot * 2, record, sizeof(record))) return false;
+    if ((record[0] & 0xFFFF0000UL) != EX_SWITCHIR_RTC_MAGIC || (record[0] & 0xFFFF) > 1) return false;
+    if (record[1] != rtcCheck(record[0])) return false;
+
+    m_bCurrentState = (record[0] & 1) ? HIGH : LOW;
+    return true;
+#else
+    return false;
+#endif
+  }
+
 
 //public
+  byte EX_SwitchIR::s_nNextRtcSlot = 0;
+
   //constructor
   EX_SwitchIR::EX_SwitchIR(const __FlashStringHelper *name, byte pin, unsigned long IRCode, int IRBits, int IRType) :
     Executor(name),
+    m_bCurrentState(LOW),
     m_IRCode(IRCode),
     m_IRBits(IRBits),
-    m_IRType(IRType)
+    m_IRType(IRType),
+    m_nRtcSlot(s_nNextRtcSlot++),
+    m_bRestored(false)
   {
     setPin(pin);
+
+    //pick up the state from before the last reset, if there is one
+    m_bRestored = restoreState();
   }
 
   //destructor
@@ -168,6 +236,11 @@ namespace st
   
   void EX_SwitchIR::init()
   {
+    //reported here rather than in the constructor, debug output is not set up that early
+    if (m_bRestored && st::Executor::debug) {
+      Serial.print(F("EX_SwitchIR::init restored state of "));
+      Serial.println(getName());
+    }
     Everything::sendSmartString(getName() + " " + (m_bCurrentState == HIGH ? F("on") : F("off")));
   }
 
@@ -187,6 +260,7 @@ namespace st
       m_bCurrentState=LOW;
     }
     
+    saveState();
     writeStateToPin();
     
     Everything::sendSmartString(getName() + " " + (m_bCurrentState == HIGH?F("on"):F("off")));
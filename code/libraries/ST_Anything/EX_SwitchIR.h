@@ -20,6 +20,7 @@
 //    2015-01-03  Dan & Daniel   Original Creation
 //    2018-08-30  Dan Ogorchock  Modified comment section above to comply with new Parent/Child Device Handler requirements
 //    2018-08-30  K Andrews      Modified to work as a class for Nexa 433 MHz remotes
+//    2026-10-18  K Andrews      Switch state is kept in ESP8266 RTC memory so it survives a reset
 //
 //
 //******************************************************************************************
@@ -40,8 +41,15 @@ namespace st
 			unsigned long m_IRCode;		//The binary ID code of the transmitter
 			int m_IRBits;	// Number of bits to send
 			int m_IRType;	// Manufacturer code to use
+			byte m_nRtcSlot;	// Slot in RTC user memory used to retain the switch state across resets
+			bool m_bRestored;	// true if the state was restored from RTC user memory at start up
+
+			static byte s_nNextRtcSlot;	// Next free RTC user memory slot, one is handed out per instance
 
 			void writeStateToPin();	//function to update the Arduino Digital Output Pin
+			unsigned long rtcCheck(unsigned long data);	//checksum for the RTC state record, includes the device name
+			void saveState();	//store m_bCurrentState in RTC user memory
+			bool restoreState();	//load m_bCurrentState from RTC user memory, returns false if no valid record
 		
 		public:
 			//constructor - called in your sketch's global variable declaration section
@@ -0,0 +1,90 @@
+//******************************************************************************************
+//  File: LocalCommandUDP.cpp
+//  Authors: K Andrews
+//
+//  Summary:  LocalCommandUDP listens for small binary UDP datagrams on the local network and
+//            feeds them into st::receiveSmartString(), the same path used for commands that
+//            arrive from the SmartThings / Hubitat hub.  See LocalCommandUDP.h for the
+//            datagram format.
+//
+//  Change History:
+//
+//    Date        Who            What
+//    ----        ---            ----
+//    2026-10-18  K Andrews      Original Creation
+//
+//******************************************************************************************
+
+#include "LocalCommandUDP.h"
+
+#include "Constants.h"
+#include "Everything.h"
+
+namespace st
+{
+//private
+	bool LocalCommandUDP::decode(int len)
+	{
+		if (len < 5 || m_Packet[0] != LOCALCOMMANDUDP_START) return false;
+
+		byte cmd = m_Packet[1];
+		byte nameLen = m_Packet[2];
+		if (cmd > 1 || nameLen == 0 || nameLen > LOCALCOMMANDUDP_MAX_NAME || len != nameLen + 4) return false;
+
+		byte check = 0;
+		for (int i = 0; i < len - 1; i++)
+		{
+			check ^= m_Packet[i];
+		}
+		if (check != m_Packet[len - 1]) return false;
+
+		//build "<name> on" or "<name> off" without giving up the reserved buffer
+		m_strMessage = "";
+		for (byte i = 0; i < nameLen; i++)
+		{
+			m_strMessage += (char)m_Packet[3 + i];
+		}
+		m_strMessage += (cmd == 1 ? F(" on") : F(" off"));
+		return true;
+	}
+
+//public
+	//constructor
+	LocalCommandUDP::LocalCommandUDP(unsigned int port) :
+		m_nPort(port)
+	{
+		m_strMessage.reserve(LOCALCOMMANDUDP_MAX_NAME + 4);
+	}
+
+	//destructor
+	LocalCommandUDP::~LocalCommandUDP()
+	{
+	}
+
+	void LocalCommandUDP::begin()
+	{
+		m_Udp.begin(m_nPort);
+		if (st::Everything::debug) {
+			Serial.print(F("LocalCommandUDP: listening on port "));
+			Serial.println(m_nPort);
+		}
+	}
+
+	void LocalCommandUDP::run()
+	{
+		//one datagram per call so a burst cannot hold up st::Everything::run(),
+		//an oversized datagram is left unread and skipped by the next parsePacket()
+		int size = m_Udp.parsePacket();
+		if (size <= 0 || size > LOCALCOMMANDUDP_MAX_PACKET) return;
+
+		int len = m_Udp.read(m_Packet, sizeof(m_Packet));
+		if (decode(len))
+		{
+			if (st::Everything::debug) {
+				Serial.print(F("LocalCommandUDP: "));
+				Serial.println(m_strMessage);
+			}
+			receiveSmartString(m_strMessage);
+		}
+	}
+}
@@ -0,0 +1,82 @@
+//******************************************************************************************
+//  File: LocalCommandUDP.h
+//  Authors: K Andrews
+//
+//  Summary:  LocalCommandUDP listens for small binary UDP datagrams on the local network and
+//            feeds them into st::receiveSmartString(), the same path used for commands that
+//            arrive from the SmartThings / Hubitat hub.  This skips the round trip through the
+//            hub, which is useful for buttons that are pressed repeatedly such as volume.
+//
+//            Create an instance of this class in your sketch's global variable section
+//            For Example:  st::LocalCommandUDP localCommands(8091);
+//
+//            st::LocalCommandUDP() constructor requires the following arguments
+//              - unsigned int port - REQUIRED - the UDP port to listen on
+//
+//            Call begin() after st::Everything::init() has connected to WiFi, and run()
+//            from the sketch's loop().  run() handles at most one datagram per call.
+//
+//            Receiving and decoding a datagram uses only fixed buffers, there is no heap
+//            allocation up to the call to st::receiveSmartString().  That function takes its
+//            String by value, so it makes one heap copy per command, and the device's
+//            beSmart() allocates as it does for commands from the hub.
+//
+// Datagram format (all fields are single bytes unless stated)
+// ----------------------------------------------------------
+//
+//   0         Start byte, always 0xA5
+//   1         Command, 0 = off, 1 = on
+//   2         Length of the device name (N), 1 to LOCALCOMMANDUDP_MAX_NAME
+//   3..N+2    Device name, e.g. "relaySwitch2" - must match the name used in the sketch
+//   N+3       Checksum, XOR of all the previous bytes
+//
+// Anything that does not match this format is ignored.
+//
+//  Change History:
+//
+//    Date        Who            What
+//    ----        ---            ----
+//    2026-10-18  K Andrews      Original Creation
+//
+//******************************************************************************************
+#ifndef ST_LOCALCOMMANDUDP_H
+#define ST_LOCALCOMMANDUDP_H
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+
+#define LOCALCOMMANDUDP_START		0xA5
+#define LOCALCOMMANDUDP_MAX_NAME	24
+#define LOCALCOMMANDUDP_MAX_PACKET	(LOCALCOMMANDUDP_MAX_NAME + 4)
+
+namespace st
+{
+	class LocalCommandUDP
+	{
+		private:
+			WiFiUDP m_Udp;		//UDP socket used to receive the commands
+			unsigned int m_nPort;	//UDP port to listen on
+			byte m_Packet[LOCALCOMMANDUDP_MAX_PACKET];	//receive buffer, reused for every datagram
+			String m_strMessage;	//command string handed to st::receiveSmartString(), reserved once and reused
+
+			bool decode(int len);	//validate the datagram in m_Packet and build m_strMessage from it
+
+		public:
+			//constructor - called in your sketch's global variable declaration section
+			LocalCommandUDP(unsigned int port);
+
+			//destructor
+			virtual ~LocalCommandUDP();
+
+			//start listening, call once WiFi is connected
+			void begin();
+
+			//process at most one datagram that has arrived, call from loop()
+			void run();
+
+			//gets
+			unsigned int getPort() const { return m_nPort; }
+	};
+}
+
+#endif
@@ -0,0 +1,58 @@
+//******************************************************************************************
+//  File: Arduino.h
+//
+//  Summary:  Minimal host stand-in for the Arduino core, just enough to build the
+//            ST_Anything_IR library files on a PC for the host tests.
+//******************************************************************************************
+#ifndef STUB_ARDUINO_H
+#define STUB_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+
+class String : public std::string
+{
+	public:
+		String() {}
+		String(const char *s) : std::string(s) {}
+		String(const std::string &s) : std::string(s) {}
+		String(const __FlashStringHelper *s) : std::string(reinterpret_cast<const char *>(s)) {}
+
+		String substring(unsigned int from) const { return from < size() ? String(substr(from)) : String(); }
+		String substring(unsigned int from, unsigned int to) const { return from < size() ? String(substr(from, to - from)) : String(); }
+		int indexOf(char c) const { size_t i = find(c); return i == npos ? -1 : (int)i; }
+		void trim();
+
+		String &operator+=(char c) { push_back(c); return *this; }
+		String &operator+=(const char *s) { append(s); return *this; }
+		String &operator+=(const __FlashStringHelper *s) { append(reinterpret_cast<const char *>(s)); return *this; }
+};
+
+inline bool operator==(const String &a, const __FlashStringHelper *b) { return a == reinterpret_cast<const char *>(b); }
+inline String operator+(const String &a, const char *b) { return String(static_cast<const std::string &>(a) + b); }
+inline String operator+(const String &a, const __FlashStringHelper *b) { return a + reinterpret_cast<const char *>(b); }
+
+class HardwareSerial
+{
+	public:
+		template <class T> void print(const T &) {}
+		template <class T> void println(const T &) {}
+		void println() {}
+};
+extern HardwareSerial Serial;
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+unsigned long millis();
+
+#endif
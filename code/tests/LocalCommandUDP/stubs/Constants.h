@@ -0,0 +1,5 @@
+//******************************************************************************************
+//  File: Constants.h
+//
+//  Summary:  Host stand-in for the ST_Anything Constants.h, nothing is needed by the tests.
+//******************************************************************************************
@@ -0,0 +1,32 @@
+//******************************************************************************************
+//  File: Device.h
+//
+//  Summary:  Host stand-in for the ST_Anything Device class.
+//******************************************************************************************
+#ifndef STUB_DEVICE_H
+#define STUB_DEVICE_H
+
+#include <Arduino.h>
+
+namespace st
+{
+	class Device
+	{
+		private:
+			String name;
+
+		public:
+			Device(const __FlashStringHelper *s) : name(s) {}
+			virtual ~Device() {}
+
+			virtual void init() {}
+			virtual void beSmart(const String &str) = 0;
+			virtual void refresh() {}
+
+			const String &getName() const { return name; }
+
+			static bool debug;
+	};
+}
+
+#endif
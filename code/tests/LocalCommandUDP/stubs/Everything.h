@@ -0,0 +1,28 @@
+//******************************************************************************************
+//  File: Everything.h
+//
+//  Summary:  Host stand-in for the ST_Anything Everything class.  receiveSmartString()
+//            keeps the upstream signature (String by value) and dispatch rules.
+//******************************************************************************************
+#ifndef STUB_EVERYTHING_H
+#define STUB_EVERYTHING_H
+
+#include "Executor.h"
+
+namespace st
+{
+	class Everything
+	{
+		public:
+			static void sendSmartString(const String &str);
+			static Device *getDeviceByName(const String &str);
+			static bool addExecutor(Executor *executor);
+
+			static bool debug;
+			static byte bTimersPending;
+	};
+
+	void receiveSmartString(String message);
+}
+
+#endif
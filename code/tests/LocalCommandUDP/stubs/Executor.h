@@ -0,0 +1,22 @@
+//******************************************************************************************
+//  File: Executor.h
+//
+//  Summary:  Host stand-in for the ST_Anything Executor class.
+//******************************************************************************************
+#ifndef STUB_EXECUTOR_H
+#define STUB_EXECUTOR_H
+
+#include "Device.h"
+
+namespace st
+{
+	class Executor : public Device
+	{
+		public:
+			Executor(const __FlashStringHelper *s) : Device(s) {}
+
+			static bool debug;
+	};
+}
+
+#endif
@@ -0,0 +1,5 @@
+//******************************************************************************************
+//  File: IRremoteESP8266.h
+//
+//  Summary:  Host stand-in, the tests only need IRsend.h.
+//******************************************************************************************
@@ -0,0 +1,50 @@
+//******************************************************************************************
+//  File: IRsend.h
+//
+//  Summary:  Host stand-in for the IRremoteESP8266 IRsend class.  Every send call records
+//            the time the IR transmission would start and the code that was sent.
+//******************************************************************************************
+#ifndef STUB_IRSEND_H
+#define STUB_IRSEND_H
+
+#include <stdint.h>
+
+namespace irstub
+{
+	extern unsigned long sends;		//number of IR codes sent
+	extern uint64_t lastCode;		//last IR code sent
+	extern uint64_t lastSendNanos;	//steady clock time of the last send, in nanoseconds
+
+	void record(uint64_t code);
+}
+
+#define IRSTUB_SEND(fn) void fn(uint64_t data, uint16_t nbits) { (void)nbits; irstub::record(data); }
+
+class IRsend
+{
+	public:
+		IRsend(uint16_t pin) { (void)pin; }
+		void begin() {}
+
+		IRSTUB_SEND(sendNEC)
+		IRSTUB_SEND(sendSony)
+		IRSTUB_SEND(sendRC5)
+		IRSTUB_SEND(sendRC6)
+		IRSTUB_SEND(sendDISH)
+		IRSTUB_SEND(sendJVC)
+		IRSTUB_SEND(sendSAMSUNG)
+		IRSTUB_SEND(sendLG)
+		IRSTUB_SEND(sendWhynter)
+		IRSTUB_SEND(sendCOOLIX)
+		IRSTUB_SEND(sendDenon)
+		IRSTUB_SEND(sendSherwood)
+		IRSTUB_SEND(sendRCMM)
+		IRSTUB_SEND(sendMitsubishi)
+		IRSTUB_SEND(sendMitsubishi2)
+		IRSTUB_SEND(sendSharpRaw)
+		IRSTUB_SEND(sendAiwaRCT501)
+		IRSTUB_SEND(sendMidea)
+		IRSTUB_SEND(sendGICable)
+};
+
+#endif
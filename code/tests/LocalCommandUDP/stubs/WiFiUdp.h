@@ -0,0 +1,31 @@
+//******************************************************************************************
+//  File: WiFiUdp.h
+//
+//  Summary:  Host stand-in for the ESP8266 WiFiUDP class, backed by a real non-blocking
+//            UDP socket bound to 127.0.0.1.  Like the ESP8266 version, parsePacket() moves
+//            on to the next datagram and discards anything left unread in the current one.
+//******************************************************************************************
+#ifndef STUB_WIFIUDP_H
+#define STUB_WIFIUDP_H
+
+#include <Arduino.h>
+
+class WiFiUDP
+{
+	private:
+		int m_nSocket;
+		byte m_Buffer[1500];
+		int m_nSize;
+		int m_nPos;
+
+	public:
+		WiFiUDP() : m_nSocket(-1), m_nSize(0), m_nPos(0) {}
+		~WiFiUDP() { stop(); }
+
+		uint8_t begin(uint16_t port);
+		void stop();
+		int parsePacket();
+		int read(byte *buffer, size_t len);
+};
+
+#endif
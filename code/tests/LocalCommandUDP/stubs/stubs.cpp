@@ -0,0 +1,139 @@
+//******************************************************************************************
+//  File: stubs.cpp
+//
+//  Summary:  Implementation of the host stand-ins used by the host tests.
+//******************************************************************************************
+#include <Arduino.h>
+#include <Everything.h>
+#include <IRsend.h>
+#include <WiFiUdp.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <vector>
+
+HardwareSerial Serial;
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+
+static uint64_t nowNanos()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+unsigned long millis()
+{
+	return (unsigned long)(nowNanos() / 1000000);
+}
+
+void String::trim()
+{
+	size_t first = find_first_not_of(" \t\r\n");
+	size_t last = find_last_not_of(" \t\r\n");
+	if (first == npos) clear();
+	else *this = String(substr(first, last - first + 1));
+}
+
+namespace irstub
+{
+	unsigned long sends = 0;
+	uint64_t lastCode = 0;
+	uint64_t lastSendNanos = 0;
+
+	void record(uint64_t code)
+	{
+		lastSendNanos = nowNanos();
+		lastCode = code;
+		sends++;
+	}
+}
+
+//WiFiUDP
+uint8_t WiFiUDP::begin(uint16_t port)
+{
+	m_nSocket = socket(AF_INET, SOCK_DGRAM, 0);
+	if (m_nSocket < 0) return 0;
+
+	sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(port);
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if (bind(m_nSocket, (sockaddr *)&addr, sizeof(addr)) != 0)
+	{
+		stop();
+		return 0;
+	}
+	return 1;
+}
+
+void WiFiUDP::stop()
+{
+	if (m_nSocket >= 0) close(m_nSocket);
+	m_nSocket = -1;
+}
+
+int WiFiUDP::parsePacket()
+{
+	m_nSize = 0;
+	m_nPos = 0;
+	if (m_nSocket < 0) return 0;
+
+	ssize_t n = recv(m_nSocket, m_Buffer, sizeof(m_Buffer), MSG_DONTWAIT);
+	if (n <= 0) return 0;
+	m_nSize = (int)n;
+	return m_nSize;
+}
+
+int WiFiUDP::read(byte *buffer, size_t len)
+{
+	int n = m_nSize - m_nPos;
+	if ((size_t)n > len) n = (int)len;
+	memcpy(buffer, m_Buffer + m_nPos, n);
+	m_nPos += n;
+	return n;
+}
+
+//Everything
+namespace st
+{
+	bool Device::debug = false;
+	bool Executor::debug = false;
+	bool Everything::debug = false;
+	byte Everything::bTimersPending = 0;
+
+	static std::vector<Device *> devices;
+
+	void Everything::sendSmartString(const String &) {}
+
+	Device *Everything::getDeviceByName(const String &str)
+	{
+		for (size_t i = 0; i < devices.size(); i++)
+		{
+			if (devices[i]->getName() == str) return devices[i];
+		}
+		return 0;
+	}
+
+	bool Everything::addExecutor(Executor *executor)
+	{
+		devices.push_back(executor);
+		return true;
+	}
+
+	void receiveSmartString(String message)
+	{
+		message.trim();
+		if (message.length() > 1)
+		{
+			Device *p = Everything::getDeviceByName(message.substring(0, message.indexOf(' ')));
+			if (p != 0) p->beSmart(message);
+		}
+	}
+}
@@ -0,0 +1,223 @@
+//******************************************************************************************
+//  File: test_LocalCommandUDP.cpp
+//
+//  Summary:  Host test for st::LocalCommandUDP.  Datagrams are sent over a real loopback UDP
+//            socket into the library code, which dispatches them through st::receiveSmartString()
+//            to an st::EX_SwitchIR.  The stub IRsend records when the IR code would start.
+//
+//            The test checks that valid datagrams switch the device and that malformed ones
+//            are rejected, then compares command-to-IR-start latency against a loopback
+//            stand-in for the hub's HTTP path (a new TCP connection carrying the request
+//            line the hub sends, parsed and passed to st::receiveSmartString()).  The network
+//            time between the hub and the board is not modelled, in practice that is where
+//            most of the saving comes from.
+//
+//  Build and run:  make
+//******************************************************************************************
+#include <Arduino.h>
+#include <Everything.h>
+#include <EX_SwitchIR.h>
+#include <IRsend.h>
+#include <LocalCommandUDP.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#define UDP_PORT	38091
+#define HTTP_PORT	38090
+#define SAMPLES		500
+
+static int failures = 0;
+
+#define CHECK(cond, what) \
+	do { \
+		if (!(cond)) { printf("FAIL: %s (line %d)\n", what, __LINE__); failures++; } \
+		else { printf("ok:   %s\n", what); } \
+	} while (0)
+
+static uint64_t nowNanos()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static sockaddr_in loopback(uint16_t port)
+{
+	sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(port);
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	return addr;
+}
+
+static std::vector<byte> frame(byte start, byte cmd, const std::string &name)
+{
+	std::vector<byte> pkt;
+	pkt.push_back(start);
+	pkt.push_back(cmd);
+	pkt.push_back((byte)name.size());
+	pkt.insert(pkt.end(), name.begin(), name.end());
+
+	byte check = 0;
+	for (size_t i = 0; i < pkt.size(); i++) check ^= pkt[i];
+	pkt.push_back(check);
+	return pkt;
+}
+
+static std::vector<byte> frame(byte cmd, const std::string &name)
+{
+	return frame(LOCALCOMMANDUDP_START, cmd, name);
+}
+
+static int udpSocket;
+
+static void sendDatagram(const std::vector<byte> &pkt)
+{
+	sockaddr_in addr = loopback(UDP_PORT);
+	sendto(udpSocket, pkt.data(), pkt.size(), 0, (sockaddr *)&addr, sizeof(addr));
+}
+
+//send one datagram and give the channel a few run() calls to act on it, returns true if an IR code was sent
+static bool deliver(st::LocalCommandUDP &channel, const std::vector<byte> &pkt)
+{
+	unsigned long before = irstub::sends;
+	sendDatagram(pkt);
+	for (int i = 0; i < 1000 && irstub::sends == before; i++) channel.run();
+	return irstub::sends != before;
+}
+
+//hub stand-in: open a new connection and send the request line the way the hub does
+static int httpListen;
+
+static void sendHttp(const char *command)
+{
+	std::string req = std::string("POST /") + command + "? HTTP/1.1\r\nHOST: 127.0.0.1:" + std::to_string(HTTP_PORT) + "\r\n\r\n";
+	for (size_t i; (i = req.find(' ', 6)) < req.find('?'); ) req.replace(i, 1, "%20");
+
+	int s = socket(AF_INET, SOCK_STREAM, 0);
+	sockaddr_in addr = loopback(HTTP_PORT);
+	connect(s, (sockaddr *)&addr, sizeof(addr));
+	send(s, req.data(), req.size(), 0);
+	close(s);
+}
+
+//board side of the HTTP path: accept, read the request line, decode it and dispatch it
+static void serveHttp()
+{
+	int c = accept(httpListen, 0, 0);
+	char buf[512];
+	std::string req;
+	ssize_t n;
+	while (req.find("\r\n\r\n") == std::string::npos && (n = recv(c, buf, sizeof(buf), 0)) > 0) req.append(buf, n);
+	close(c);
+
+	std::string cmd = req.substr(req.find('/') + 1, req.find('?') - req.find('/') - 1);
+	for (size_t i; (i = cmd.find("%20")) != std::string::npos; ) cmd.replace(i, 3, " ");
+	st::receiveSmartString(String(cmd));
+}
+
+static double median(std::vector<double> v)
+{
+	std::sort(v.begin(), v.end());
+	return v[v.size() / 2];
+}
+
+int main()
+{
+	static st::EX_SwitchIR executor1(F("switch1"), 4, 0xE0E040BF, 32, 7);
+	st::Everything::addExecutor(&executor1);
+
+	st::LocalCommandUDP channel(UDP_PORT);
+	channel.begin();
+	udpSocket = socket(AF_INET, SOCK_DGRAM, 0);
+
+	//valid commands
+	CHECK(deliver(channel, frame(1, "switch1")) && executor1.getStatus() == HIGH, "on datagram switches the device on");
+	CHECK(irstub::lastCode == 0xE0E040BF, "the device's IR code is sent");
+	CHECK(deliver(channel, frame(0, "switch1")) && executor1.getStatus() == LOW, "off datagram switches the device off");
+
+	//malformed datagrams
+	std::vector<byte> badStart = frame(0x5A, 1, "switch1");
+	CHECK(!deliver(channel, badStart), "wrong start byte is rejected");
+
+	CHECK(!deliver(channel, frame(2, "switch1")), "cmd > 1 is rejected");
+
+	std::vector<byte> emptyName = frame(1, "");
+	CHECK(!deliver(channel, emptyName), "name length 0 is rejected");
+
+	CHECK(deliver(channel, frame(1, std::string(LOCALCOMMANDUDP_MAX_NAME, 'x'))) == false, "unknown device of maximum name length is ignored by dispatch");
+	std::vector<byte> longName = frame(1, std::string(LOCALCOMMANDUDP_MAX_NAME + 1, 'x'));
+	longName.resize(LOCALCOMMANDUDP_MAX_PACKET);	//keep it within the receive buffer so decode() sees it
+	CHECK(!deliver(channel, longName), "name length > 24 is rejected");
+
+	std::vector<byte> shortLen = frame(1, "switch1");
+	shortLen[2] = 6;
+	byte check = 0;
+	for (size_t i = 0; i + 1 < shortLen.size(); i++) check ^= shortLen[i];
+	shortLen.back() = check;
+	CHECK(!deliver(channel, shortLen), "name length that does not match the datagram is rejected");
+
+	std::vector<byte> badXor = frame(1, "switch1");
+	badXor.back() ^= 0x01;
+	CHECK(!deliver(channel, badXor), "bad XOR checksum is rejected");
+
+	CHECK(!deliver(channel, std::vector<byte>(200, LOCALCOMMANDUDP_START)), "oversized datagram is skipped");
+	CHECK(executor1.getStatus() == LOW, "rejected datagrams leave the device unchanged");
+	CHECK(deliver(channel, frame(1, "switch1")), "a valid datagram after rejected ones still works");
+
+	//one datagram per run()
+	unsigned long before = irstub::sends;
+	sendDatagram(frame(0, "switch1"));
+	sendDatagram(frame(1, "switch1"));
+	usleep(10000);
+	channel.run();
+	CHECK(irstub::sends == before + 1, "run() handles one datagram per call");
+	channel.run();
+	CHECK(irstub::sends == before + 2, "the next run() handles the next datagram");
+
+	//latency, command sent to IR start
+	httpListen = socket(AF_INET, SOCK_STREAM, 0);
+	int on = 1;
+	setsockopt(httpListen, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+	sockaddr_in addr = loopback(HTTP_PORT);
+	bind(httpListen, (sockaddr *)&addr, sizeof(addr));
+	listen(httpListen, 4);
+
+	std::vector<double> udpMicros, httpMicros;
+	for (int i = 0; i < SAMPLES; i++)
+	{
+		std::vector<byte> pkt = frame(i & 1, "switch1");
+		unsigned long sends = irstub::sends;
+		uint64_t start = nowNanos();
+		sendDatagram(pkt);
+		while (irstub::sends == sends) channel.run();
+		udpMicros.push_back((irstub::lastSendNanos - start) / 1000.0);
+
+		sends = irstub::sends;
+		start = nowNanos();
+		sendHttp((i & 1) ? "switch1 on" : "switch1 off");
+		serveHttp();
+		if (irstub::sends == sends) { printf("FAIL: HTTP command did not reach IR send\n"); failures++; break; }
+		httpMicros.push_back((irstub::lastSendNanos - start) / 1000.0);
+	}
+
+	double udp = median(udpMicros);
+	double http = median(httpMicros);
+	printf("median command-to-IR-start over %d samples: UDP %.1f us, HTTP %.1f us (loopback, hub round trip not included)\n", SAMPLES, udp, http);
+	CHECK(udp < http, "UDP path reaches IR start sooner than the HTTP path");
+
+	close(httpListen);
+	close(udpSocket);
+
+	printf(failures ? "%d FAILED\n" : "all passed\n", failures);
+	return failures ? 1 : 0;
+}